@@ -13,7 +13,8 @@
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 
-#include <map>
+#include <cstring>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -110,20 +111,39 @@ class FlameRtable : public Object
     LookupResult Lookup(Mac48Address destination);
 
   private:
-    /// Routing table entry
+    /// Routing table entry, field widths and order chosen to avoid padding
     struct Route
     {
+        Time whenExpire;            ///< expire when?
         Mac48Address retransmitter; ///< retransmitter
         uint32_t interface;         ///< interface
-        uint32_t cost;              ///< cost
-        Time whenExpire;            ///< expire when?
-        uint32_t seqnum;            ///< sequence number
+        uint16_t seqnum;            ///< sequence number
+        uint8_t cost;               ///< cost, bounded by MAX_COST
+    };
+
+    /// Hash functor for a routing table key
+    struct Mac48AddressHash
+    {
+        /**
+         * Functional operator for MAC address hash computation.
+         *
+         * \param address the MAC address
+         * \return the hash
+         */
+        std::size_t operator()(const Mac48Address& address) const
+        {
+            uint8_t buffer[6];
+            address.CopyTo(buffer);
+            uint64_t packed = 0;
+            std::memcpy(&packed, buffer, 6);
+            return std::hash<uint64_t>{}(packed);
+        }
     };
 
     /// Lifetime parameter
     Time m_lifetime;
     /// List of routes
-    std::map<Mac48Address, Route> m_routes;
+    std::unordered_map<Mac48Address, Route, Mac48AddressHash> m_routes;
 };
 
 } // namespace flame
@@ -392,6 +392,28 @@ AnimationInterface::UpdateNodeColor(uint32_t nodeId, uint8_t r, uint8_t g, uint8
     WriteXmlUpdateNodeColor(nodeId, r, g, b);
 }
 
+void
+AnimationInterface::UpdateNodeColorBatch(const std::vector<NodeColor>& colors)
+{
+    std::string buffer;
+    for (const auto& [nodeId, r, g, b] : colors)
+    {
+        NS_ASSERT(NodeList::GetNode(nodeId));
+        NS_LOG_INFO("Setting node color for Node Id:" << nodeId);
+        Rgb rgb = {r, g, b};
+        m_nodeColors[nodeId] = rgb;
+        AnimXmlElement element("nu");
+        element.AddAttribute("p", "c");
+        element.AddAttribute("t", Simulator::Now().GetSeconds());
+        element.AddAttribute("id", nodeId);
+        element.AddAttribute("r", (uint32_t)r);
+        element.AddAttribute("g", (uint32_t)g);
+        element.AddAttribute("b", (uint32_t)b);
+        buffer += element.ToString();
+    }
+    WriteN(buffer, m_f);
+}
+
 void
 AnimationInterface::UpdateLinkDescription(uint32_t fromNode,
                                           uint32_t toNode,
@@ -33,6 +33,8 @@
 #include <cstdio>
 #include <map>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -311,6 +313,19 @@ class AnimationInterface
      */
     void UpdateNodeColor(uint32_t nodeId, uint8_t r, uint8_t g, uint8_t b);
 
+    /// Tuple of node Id and red, green, blue component values (0-255)
+    typedef std::tuple<uint32_t, uint8_t, uint8_t, uint8_t> NodeColor;
+
+    /**
+     * \brief Helper function to update the color of several nodes at once
+     *
+     * The color updates are serialized into a single write to the trace
+     * file instead of one write (and flush) per node.
+     *
+     * \param colors list of (node Id, r, g, b) tuples
+     */
+    void UpdateNodeColorBatch(const std::vector<NodeColor>& colors);
+
     /**
      * \brief Helper function to update a node's counter referenced by the nodeCounterId
      * \param nodeCounterId The counter Id obtained from AddNodeCounter
@@ -58,6 +58,12 @@ NetDeviceContainer::Get(uint32_t i) const
     return m_devices[i];
 }
 
+void
+NetDeviceContainer::Reserve(uint32_t n)
+{
+    m_devices.reserve(m_devices.size() + n);
+}
+
 void
 NetDeviceContainer::Add(NetDeviceContainer other)
 {
@@ -162,6 +162,16 @@ class NetDeviceContainer
      */
     Ptr<NetDevice> Get(uint32_t i) const;
 
+    /**
+     * \brief Reserve storage for n device pointers.
+     *
+     * Pre-sizing the underlying vector avoids repeated reallocations while
+     * helpers append devices for large topologies.
+     *
+     * \param n The expected number of NetDevices in this container
+     */
+    void Reserve(uint32_t n);
+
     /**
      * \brief Append the contents of another NetDeviceContainer to the end of
      * this container.
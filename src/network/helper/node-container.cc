@@ -87,6 +87,12 @@ NodeContainer::Create(uint32_t n, uint32_t systemId)
     }
 }
 
+void
+NodeContainer::Reserve(uint32_t n)
+{
+    m_nodes.reserve(m_nodes.size() + n);
+}
+
 void
 NodeContainer::Add(const NodeContainer& nc)
 {
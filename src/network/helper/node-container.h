@@ -215,6 +215,16 @@ class NodeContainer
      */
     void Create(uint32_t n, uint32_t systemId);
 
+    /**
+     * \brief Reserve storage for n node pointers.
+     *
+     * Pre-sizing the underlying vector avoids the repeated reallocations
+     * that Create and Add otherwise incur when building large topologies.
+     *
+     * \param n The expected number of Nodes in this container
+     */
+    void Reserve(uint32_t n);
+
     /**
      * \brief Append the contents of another NodeContainer to the end of
      * this container.